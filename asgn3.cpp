@@ -6,6 +6,11 @@
 #include <stdexcept>
 #include <exception>
 #include <algorithm>
+#include <utility>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 
 using namespace std;
@@ -99,6 +104,30 @@ public:
         rename("temp.txt", "dns.txt");
     }
 
+    // Look up several domains in a single pass over the file (used for batched prefetching).
+    // Domains that are not in the file are simply left out of the result.
+    vector<pair<string, string>> get_ip_addresses_from_file(const vector<string>& domain_names) {
+        ifstream dnsFile("dns.txt", ios::in);
+        if (!dnsFile.is_open()) {
+            throw FileNotFoundException();
+        }
+
+        vector<pair<string, string>> found;
+        string line;
+        while (getline(dnsFile, line) && found.size() < domain_names.size()) {
+            size_t pos = line.find('=');
+            if (pos == string::npos) {
+                continue;
+            }
+            string domain = line.substr(0, pos);
+            if (find(domain_names.begin(), domain_names.end(), domain) != domain_names.end()) {
+                found.push_back({domain, line.substr(pos + 1)});
+            }
+        }
+        dnsFile.close();
+        return found;
+    }
+
     void print_dns_file(const string& filename) {
         ifstream dnsFile(filename, ios::in);
         if (!dnsFile.is_open()) {
@@ -397,7 +426,7 @@ class CacheManager {
             return new Node(domain, ip);
         }
     
-        void print_cache() {
+        virtual void print_cache() {
             if (!head) {
                 throw CacheEmptyException();
             }
@@ -528,6 +557,258 @@ class CacheManager {
         }
     };
     
+    // Refresh-ahead Cache Implementation
+    // Builds on LFU, but hotness is not the lifetime frequency (that is only used for eviction):
+    // every entry counts its hits since it was last loaded or picked for a refresh. A background
+    // thread re-reads entries that were hot during their current TTL shortly before it runs out, and warms the "www." / apex partner of every missed
+    // name, so popular records are never served by a miss.
+    // Timing must satisfy 0 < scan interval < refresh-ahead < TTL, otherwise a hot entry is either
+    // re-read on every scan or can expire between two scans.
+    class RefreshAheadCacheManager : public LFUCacheManager {
+    protected:
+        struct RefreshNode : public LFUNode {
+            chrono::steady_clock::time_point loaded_at;
+            chrono::steady_clock::time_point useful_after;  // a hit from here on needed the prefetch
+            int window_hits;  // hits since the entry was last loaded or picked for a refresh
+            bool prefetched;  // loaded/refreshed by the background thread and not yet counted useful
+            long generation;  // value of write_generation when the foreground last stored this entry
+            RefreshNode(const string& d, const string& i)
+                : LFUNode(d, i), loaded_at(chrono::steady_clock::now()), useful_after(loaded_at),
+                  window_hits(0), prefetched(false), generation(0) {}
+        };
+
+        chrono::milliseconds ttl;
+        chrono::milliseconds refresh_ahead;  // refresh hot entries this long before they expire
+        chrono::milliseconds scan_interval;
+        int hot_threshold;                   // hits per TTL needed for an entry to count as hot
+
+        mutex cache_mutex;
+        condition_variable worker_cv;
+        vector<string> warm_queue;
+        long write_generation;  // bumped whenever the foreground stores a fresh record
+        long file_writes;       // bumped whenever the foreground writes the DNS file
+        bool stopping;
+        thread worker;
+
+        int hits;
+        int misses;
+        int prefetches_issued;
+        int prefetches_useful;
+
+        static RefreshNode* as_refresh(Node* node) {
+            return static_cast<RefreshNode*>(node);
+        }
+
+        // Names that are usually looked up together: "www.x.com" <-> "x.com"
+        static string co_accessed_name(const string& domain) {
+            if (domain.compare(0, 4, "www.") == 0) return domain.substr(4);
+            return "www." + domain;
+        }
+
+        // Mark an entry as freshly stored by the foreground; called with cache_mutex held
+        void stamp_foreground_write(RefreshNode* node) {
+            node->loaded_at = chrono::steady_clock::now();
+            node->window_hits = 0;
+            node->prefetched = false;
+            node->generation = ++write_generation;
+        }
+
+        // Record an add_update_cache, whether or not its file write went through
+        void stamp_cache_write(const string& domain) {
+            file_writes++;
+            Node* node = find_node(domain);
+            if (node) stamp_foreground_write(as_refresh(node));
+        }
+
+        // Pick the batch for one background pass; called with cache_mutex held
+        vector<string> collect_prefetch_batch(vector<string>& warm) {
+            vector<string> batch;
+            auto now = chrono::steady_clock::now();
+            for (Node* current = head; current; current = current->next) {
+                RefreshNode* node = as_refresh(current);
+                auto age = now - node->loaded_at;
+                bool hot = node->window_hits >= hot_threshold;
+                bool refresh_due = age >= ttl - refresh_ahead;
+                // Expired entries are left to the foreground miss path
+                if (hot && refresh_due && age < ttl) {
+                    batch.push_back(node->domain);
+                    // Counts as the refresh attempt even if the record is gone or the read fails,
+                    // so the entry has to earn its hotness again before it is retried
+                    node->window_hits = 0;
+                }
+            }
+
+            for (const auto& domain : warm_queue) {
+                if (!find_node(domain) && find(warm.begin(), warm.end(), domain) == warm.end()) {
+                    warm.push_back(domain);
+                    batch.push_back(domain);
+                }
+            }
+            warm_queue.clear();
+            return batch;
+        }
+
+        // Store the prefetched records; called with cache_mutex held.
+        // The file was read without the lock, so anything the foreground stored after the batch
+        // was collected is newer than these results and must not be overwritten.
+        void apply_prefetch_batch(const vector<pair<string, string>>& results, const vector<string>& warm,
+                                  long batch_generation, long batch_file_writes) {
+            for (const auto& entry : results) {
+                Node* node = find_node(entry.first);
+                if (node) {
+                    RefreshNode* refreshed = as_refresh(node);
+                    if (refreshed->generation > batch_generation) continue;
+                    refreshed->useful_after = refreshed->loaded_at + ttl;
+                    refreshed->ip = entry.second;
+                    refreshed->loaded_at = chrono::steady_clock::now();
+                    refreshed->prefetched = true;
+                    prefetches_issued++;
+                } else if (find(warm.begin(), warm.end(), entry.first) != warm.end()
+                           && file_writes == batch_file_writes && current_size < max_cache_size) {
+                    // Only warm into free slots so a guess never evicts a real entry
+                    RefreshNode* warmed = new RefreshNode(entry.first, entry.second);
+                    warmed->prefetched = true;
+                    add_to_front(warmed);
+                    prefetches_issued++;
+                }
+            }
+        }
+
+        void refresh_loop() {
+            unique_lock<mutex> lock(cache_mutex);
+            while (!stopping) {
+                worker_cv.wait_for(lock, scan_interval, [this] { return stopping || !warm_queue.empty(); });
+                if (stopping) break;
+
+                vector<string> warm;
+                vector<string> batch = collect_prefetch_batch(warm);
+                if (batch.empty()) continue;
+                long batch_generation = write_generation;
+                long batch_file_writes = file_writes;
+
+                // Do the file read without blocking foreground lookups
+                lock.unlock();
+                vector<pair<string, string>> results;
+                try {
+                    results = dnsManager.get_ip_addresses_from_file(batch);
+                } catch (const exception&) {
+                    // File is missing or being rewritten; try again on the next pass
+                }
+                lock.lock();
+
+                apply_prefetch_batch(results, warm, batch_generation, batch_file_writes);
+            }
+        }
+
+    public:
+        RefreshAheadCacheManager(int max_size,
+                                 chrono::milliseconds ttl_ms = chrono::milliseconds(5000),
+                                 chrono::milliseconds refresh_ahead_ms = chrono::milliseconds(1000),
+                                 chrono::milliseconds scan_ms = chrono::milliseconds(200),
+                                 int hot_hits = 2)
+            : LFUCacheManager(max_size), ttl(ttl_ms), refresh_ahead(refresh_ahead_ms), scan_interval(scan_ms),
+              hot_threshold(hot_hits), write_generation(0), file_writes(0), stopping(false), hits(0), misses(0),
+              prefetches_issued(0), prefetches_useful(0) {
+            if (scan_interval.count() <= 0 || scan_interval >= refresh_ahead || refresh_ahead >= ttl) {
+                throw invalid_argument("Refresh-ahead timing must satisfy 0 < scan < refresh-ahead < TTL.");
+            }
+            if (hot_threshold < 1) {
+                throw invalid_argument("Hot threshold must be at least 1.");
+            }
+            worker = thread(&RefreshAheadCacheManager::refresh_loop, this);
+        }
+
+        ~RefreshAheadCacheManager() override {
+            {
+                lock_guard<mutex> lock(cache_mutex);
+                stopping = true;
+            }
+            worker_cv.notify_one();
+            worker.join();
+        }
+
+        string get_ip_address(const string& domain_name) override {
+            if (domain_name.empty()) {
+                throw InvalidDomainException();
+            }
+            lock_guard<mutex> lock(cache_mutex);
+
+            RefreshNode* node = as_refresh(find_node(domain_name));
+            auto now = chrono::steady_clock::now();
+            if (node && now - node->loaded_at < ttl) {
+                hits++;
+                // A refreshed entry only counts once the hit lands past its old expiry
+                if (node->prefetched && now >= node->useful_after) {
+                    prefetches_useful++;
+                    node->prefetched = false;
+                }
+                node->window_hits++;
+                increment_frequency(node);
+                move_to_front(node);
+                return node->ip;
+            }
+
+            misses++;
+            string ip = dnsManager.get_ip_address_from_file(domain_name);
+            if (ip.empty()) {
+                throw InvalidDomainException();
+            }
+
+            if (node) {
+                // Expired before the background thread got to it: reload in place so the
+                // LFU frequency survives the miss
+                node->ip = ip;
+                stamp_foreground_write(node);
+                node->window_hits++;
+                increment_frequency(node);
+                move_to_front(node);
+                return ip;
+            }
+
+            RefreshNode* new_node = new RefreshNode(domain_name, ip);
+            stamp_foreground_write(new_node);
+            new_node->window_hits++;
+            if (current_size == max_cache_size) {
+                evict();
+            }
+            add_to_front(new_node);
+
+            warm_queue.push_back(co_accessed_name(domain_name));
+            worker_cv.notify_one();
+            return ip;
+        }
+
+        void add_update_cache(const string& domain, const string& ip) override {
+            lock_guard<mutex> lock(cache_mutex);
+            // The cache holds the new IP before the file is written, so stamp it even if that throws
+            try {
+                LFUCacheManager::add_update_cache(domain, ip);
+            } catch (...) {
+                stamp_cache_write(domain);
+                throw;
+            }
+            stamp_cache_write(domain);
+        }
+
+        Node* create_node(const string& domain, const string& ip) override {
+            return new RefreshNode(domain, ip);
+        }
+
+        void print_cache() override {
+            lock_guard<mutex> lock(cache_mutex);
+            LFUCacheManager::print_cache();
+        }
+
+        void print_prefetch_stats() {
+            lock_guard<mutex> lock(cache_mutex);
+            double useful_percent = prefetches_issued > 0 ? (prefetches_useful * 100.0 / prefetches_issued) : 0;
+            cout << "\nRefresh-ahead Statistics:" << endl;
+            cout << "Hits: " << hits << ", Misses: " << misses << endl;
+            cout << "Prefetches issued: " << prefetches_issued << endl;
+            cout << "Prefetches useful: " << prefetches_useful << " (" << useful_percent << "%)" << endl;
+        }
+    };
+    
 
 
 
@@ -650,6 +931,35 @@ class CacheManager {
             lifoCache.add_update_cache("github.com", "3.3.3.3");
             lifoCache.print_cache();
     
+            cout << "\n=== Refresh-ahead Cache Manager ===" << endl;
+            RefreshAheadCacheManager refreshCache(5, chrono::milliseconds(600), chrono::milliseconds(300),
+                                                  chrono::milliseconds(100));
+    
+            // Add items to the refresh-ahead cache
+            cout << "\nAdding items to refresh-ahead cache..." << endl;
+            refreshCache.add_update_cache("example.com", "1.1.1.1");
+            refreshCache.add_update_cache("www.google.com", "8.8.8.8");
+            refreshCache.add_update_cache("google.com", "8.8.4.4");
+            refreshCache.print_cache();
+    
+            // Keep example.com hot across several TTLs; the background thread keeps it fresh
+            cout << "\nAccessing example.com repeatedly over several TTLs..." << endl;
+            for (int i = 0; i < 10; i++) {
+                refreshCache.get_ip_address("example.com");
+                this_thread::sleep_for(chrono::milliseconds(150));
+            }
+    
+            // A miss on an apex name warms its "www." partner in the background
+            cout << "\nLooking up github.com (miss), which warms www.github.com..." << endl;
+            DNSManager dnsFile;
+            dnsFile.add_update_dns_file("github.com", "3.3.3.3");
+            dnsFile.add_update_dns_file("www.github.com", "3.3.3.4");
+            refreshCache.get_ip_address("github.com");
+            this_thread::sleep_for(chrono::milliseconds(150));
+            refreshCache.print_cache();
+            cout << "www.github.com: " << refreshCache.get_ip_address("www.github.com") << endl;
+            refreshCache.print_prefetch_stats();
+    
         } catch (const exception& e) {
             cout << "Unhandled error: " << e.what() << endl;
         }